@@ -48,7 +48,13 @@ export class AppComponent implements OnDestroy {
   // Web Audio API properties
   private audioContext: AudioContext | null = null;
   private analyser: AnalyserNode | null = null;
+  // Higher-resolution analyser used only by the bars view, so its low bands resolve distinct bins.
+  private barsAnalyser: AnalyserNode | null = null;
+  private barsFrequencyDataArray: Uint8Array | null = null;
   private source: MediaElementAudioSourceNode | null = null;
+  // Browser-reported output latency of the AudioContext (base + output stage), in ms.
+  // This is the browser's own playback path, independent of the selected device.
+  private reportedOutputLatency = signal<number | null>(null);
   private frequencyDataArray: Uint8Array | null = null;
   private timeDomainDataArray: Uint8Array | null = null;
   private animationFrameId: number | null = null;
@@ -57,9 +63,17 @@ export class AppComponent implements OnDestroy {
   private spectrogramCtx: CanvasRenderingContext2D | null = null;
   private waveformCtx: CanvasRenderingContext2D | null = null;
   private barsCtx: CanvasRenderingContext2D | null = null;
-  private smoothedBarHeights: number[] = Array(32).fill(0);
+  private readonly barCount = 32;
+  private smoothedBarHeights: number[] = Array(this.barCount).fill(0);
+  private peakBarHeights: number[] = Array(this.barCount).fill(0);
+  private peakHoldFrames: number[] = Array(this.barCount).fill(0);
+  private readonly barMinFrequency = 30;
+  // [startBin, endBin) per bar, log-spaced from barMinFrequency up to Nyquist.
+  private barBandRanges: Array<[number, number]> = [];
 
   // --- DERIVED STATE (COMPUTED SIGNALS) ---
+  browserOutputLatency = this.reportedOutputLatency.asReadonly();
+
   selectedDevice = computed(() => {
     const id = this.selectedDeviceId();
     if (id === null) return null;
@@ -95,6 +109,8 @@ export class AppComponent implements OnDestroy {
               this.animationFrameId = null;
             }
             this.smoothedBarHeights.fill(0);
+            this.peakBarHeights.fill(0);
+            this.peakHoldFrames.fill(0);
             this.clearCanvases();
           }
         });
@@ -138,6 +154,7 @@ export class AppComponent implements OnDestroy {
     }
     this.source?.disconnect();
     this.analyser?.disconnect();
+    this.barsAnalyser?.disconnect();
     this.audioContext?.close();
     if (this.objectUrl) {
       URL.revokeObjectURL(this.objectUrl);
@@ -200,6 +217,32 @@ export class AppComponent implements OnDestroy {
     const frequencyBinCount = this.analyser.frequencyBinCount;
     this.frequencyDataArray = new Uint8Array(frequencyBinCount);
     this.timeDomainDataArray = new Uint8Array(this.analyser.fftSize);
+
+    // An 8192-point FFT gives ~5.9 Hz bins at 48 kHz, fine enough that the lowest
+    // log bands map to distinct bins instead of collapsing into linear 1-bin bars.
+    this.barsAnalyser = this.audioContext.createAnalyser();
+    this.barsAnalyser.fftSize = 8192;
+    this.source.connect(this.barsAnalyser);
+    this.barsFrequencyDataArray = new Uint8Array(this.barsAnalyser.frequencyBinCount);
+    this.barBandRanges = this.computeLogBandRanges(
+      this.barsAnalyser.frequencyBinCount, this.audioContext.sampleRate, this.barCount);
+  }
+
+  // Splits barMinFrequency..Nyquist into log-spaced bin ranges. A band narrower than
+  // one bin is widened to a single bin; at 44.1/48 kHz this only affects the lowest bar or two.
+  private computeLogBandRanges(binCount: number, sampleRate: number, bandCount: number): Array<[number, number]> {
+    const ranges: Array<[number, number]> = [];
+    const minBin = this.barMinFrequency / (sampleRate / 2 / binCount);
+    const ratio = Math.log(binCount / minBin) / bandCount;
+    let start = Math.max(1, Math.round(minBin));
+    for (let i = 0; i < bandCount; i++) {
+      const remaining = bandCount - i - 1;
+      let end = Math.round(minBin * Math.exp(ratio * (i + 1)));
+      end = Math.min(Math.max(end, start + 1), binCount - remaining);
+      ranges.push([start, end]);
+      start = end;
+    }
+    return ranges;
   }
 
   private runVisualizer(): void {
@@ -222,20 +265,31 @@ export class AppComponent implements OnDestroy {
     draw();
   }
 
+  private updateReportedLatency(): void {
+    if (!this.audioContext || this.audioContext.state !== 'running') return;
+    // outputLatency is not implemented in every browser; fall back to baseLatency alone.
+    const seconds = this.audioContext.baseLatency + (this.audioContext.outputLatency ?? 0);
+    if (!Number.isFinite(seconds) || seconds <= 0) return;
+    this.reportedOutputLatency.set(parseFloat((seconds * 1000).toFixed(2)));
+  }
+
   private drawBars(): void {
-    if (!this.barsCtx || !this.analyser || !this.frequencyDataArray) return;
+    if (!this.barsCtx || !this.barsAnalyser || !this.barsFrequencyDataArray) return;
     
     const canvas = this.barsCtx.canvas;
-    this.analyser.getByteFrequencyData(this.frequencyDataArray);
+    this.barsAnalyser.getByteFrequencyData(this.barsFrequencyDataArray);
     
     this.barsCtx.clearRect(0, 0, canvas.width, canvas.height);
     
-    const barCount = 32;
+    const barCount = this.barCount;
     // Spacing between bars is 15% of the total slot width for a bar.
     const barWidth = (canvas.width / barCount) * 0.85;
     const barSpacing = canvas.width / barCount - barWidth;
-    const binsPerBar = Math.floor(this.analyser.frequencyBinCount / barCount);
-    const smoothingFactor = 0.8;
+    // Rise quickly, fall slowly; peaks hold briefly before decaying.
+    const attack = 0.5;
+    const release = 0.88;
+    const peakHoldFrameCount = 30;
+    const peakDecay = 0.96;
     
     let x = 0;
 
@@ -250,17 +304,31 @@ export class AppComponent implements OnDestroy {
     this.barsCtx.shadowBlur = 8;
     
     for (let i = 0; i < barCount; i++) {
+        // Byte frequency data is already dB-scaled by the analyser, so the band
+        // average is a dB average rather than a linear power average.
+        const [start, end] = this.barBandRanges[i];
         let sum = 0;
-        for (let j = 0; j < binsPerBar; j++) {
-            sum += this.frequencyDataArray[i * binsPerBar + j];
+        for (let j = start; j < end; j++) {
+            sum += this.barsFrequencyDataArray[j];
         }
-        const avg = sum / binsPerBar;
+        const avg = sum / (end - start);
         const targetHeight = (avg / 255) * canvas.height;
         
-        // Apply smoothing
-        this.smoothedBarHeights[i] = this.smoothedBarHeights[i] * smoothingFactor + targetHeight * (1 - smoothingFactor);
+        // Apply attack/release smoothing
+        const current = this.smoothedBarHeights[i];
+        const coefficient = targetHeight > current ? attack : release;
+        this.smoothedBarHeights[i] = current * coefficient + targetHeight * (1 - coefficient);
         const barHeight = Math.max(1, this.smoothedBarHeights[i]);
         
+        if (barHeight >= this.peakBarHeights[i]) {
+            this.peakBarHeights[i] = barHeight;
+            this.peakHoldFrames[i] = peakHoldFrameCount;
+        } else if (this.peakHoldFrames[i] > 0) {
+            this.peakHoldFrames[i]--;
+        } else {
+            this.peakBarHeights[i] = Math.max(barHeight, this.peakBarHeights[i] * peakDecay);
+        }
+        
         const y = canvas.height - barHeight;
         
         this.barsCtx.fillRect(x, y, barWidth, barHeight);
@@ -270,6 +338,14 @@ export class AppComponent implements OnDestroy {
     // Reset shadow
     this.barsCtx.shadowBlur = 0;
     this.barsCtx.shadowColor = 'transparent';
+
+    // Peak-hold markers, drawn without glow and clamped so a clipped peak stays visible
+    x = 0;
+    for (let i = 0; i < barCount; i++) {
+        const peakY = Math.max(0, canvas.height - this.peakBarHeights[i] - 2);
+        this.barsCtx.fillRect(x, peakY, barWidth, 2);
+        x += barWidth + barSpacing;
+    }
   }
 
   private drawWaveform(): void {
@@ -351,10 +427,14 @@ export class AppComponent implements OnDestroy {
       this.audio.pause();
     } else {
       if (!this.audioContext) this.setupAudioContext();
-      if (this.audioContext && this.audioContext.state === 'suspended') {
-        this.audioContext.resume();
-      }
-      this.audio.play().catch(e => console.error("Error playing audio:", e));
+      const resumed = this.audioContext && this.audioContext.state === 'suspended'
+        ? this.audioContext.resume()
+        : Promise.resolve();
+      // Read the reported latency once the context is running, not per frame.
+      this.audio.play()
+        .then(() => resumed)
+        .then(() => this.updateReportedLatency())
+        .catch(e => console.error("Error playing audio:", e));
     }
   }
   